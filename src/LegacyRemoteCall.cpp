@@ -4,6 +4,9 @@
 
 namespace RemoteCall {
 extern void removeAllFunc();
+#ifdef LEGACY_REMOTE_CALL_TEST
+extern void testExportTable();
+#endif // LEGACY_REMOTE_CALL_TEST
 }
 namespace legacy_remote_call_api {
 
@@ -14,7 +17,12 @@ LegacyRemoteCallAPI& LegacyRemoteCallAPI::getInstance() {
 
 bool LegacyRemoteCallAPI::load() { return true; }
 
-bool LegacyRemoteCallAPI::enable() { return true; }
+bool LegacyRemoteCallAPI::enable() {
+#ifdef LEGACY_REMOTE_CALL_TEST
+    RemoteCall::testExportTable();
+#endif // LEGACY_REMOTE_CALL_TEST
+    return true;
+}
 
 bool LegacyRemoteCallAPI::disable() {
     RemoteCall::removeAllFunc();
@@ -4,35 +4,165 @@
 #include "RemoteCallAPI.h"
 
 namespace RemoteCall {
-CallbackFn const                                              EMPTY_FUNC{};
-std::unordered_map<std::string, RemoteCall::ExportedFuncData> exportedFuncs;
+struct FuncKey {
+    std::string key;
+    size_t      hash;
+    FuncKey(std::string_view nameSpace, std::string_view funcName, size_t hash)
+    : key(fmt::format("{}::{}", nameSpace, funcName)),
+      hash(hash) {}
+    FuncKey(std::string_view nameSpace, std::string_view funcName)
+    : FuncKey(nameSpace, funcName, hashKey(nameSpace, funcName)) {}
+    bool operator==(FuncKey const& other) const { return hash == other.hash && key == other.key; }
+};
+struct FuncKeyHash {
+    size_t operator()(FuncKey const& key) const { return key.hash; }
+};
+struct ExportWaiter {
+    void*                 handle;
+    std::function<void()> callback;
+};
+
+CallbackFn const                                                             EMPTY_FUNC{};
+std::unordered_map<FuncKey, ExportedFuncData, FuncKeyHash>                   exportedFuncs;
+std::unordered_map<FuncKey, std::weak_ptr<ImportBinding>, FuncKeyHash>       importBindings;
+std::unordered_map<FuncKey, std::vector<ExportWaiter>, FuncKeyHash>          exportWaiters;
+size_t                                                                       removedFuncs = 0;
+size_t                                                                       nextPrune    = 64;
 
 ll::io::Logger& getLogger() { return legacy_remote_call_api::LegacyRemoteCallAPI::getInstance().getSelf().getLogger();}
 
+// Drops bindings whose lazy imports are all gone, amortized over the calls of bindFunc
+void pruneBindings() {
+    if (importBindings.size() < nextPrune) return;
+    std::erase_if(importBindings, [](auto& pair) { return pair.second.expired(); });
+    nextPrune = std::max<size_t>(64, importBindings.size() * 2);
+}
+
+void updateBinding(FuncKey const& key, CallbackFn const* callback) {
+    auto iter = importBindings.find(key);
+    if (iter == importBindings.end()) return;
+    if (auto binding = iter->second.lock()) binding->callback = callback;
+    else importBindings.erase(iter);
+}
+
+void onExported(FuncKey const& key, CallbackFn const& callback) {
+    updateBinding(key, &callback);
+    // Detach waiters first, they may export or wait for other functions
+    auto node = exportWaiters.extract(key);
+    if (node.empty()) return;
+    for (auto& waiter : node.mapped()) {
+        waiter.callback();
+    }
+}
+
 bool exportFunc(std::string const& nameSpace, std::string const& funcName, CallbackFn&& callback, void* handle) {
     if (nameSpace.find("::") != std::string::npos) {
         getLogger().error("Namespace can't includes \"::\"");
         return false;
     }
-    if (exportedFuncs.count(nameSpace + "::" + funcName) != 0) return false;
-    exportedFuncs.emplace(nameSpace + "::" + funcName, ExportedFuncData{handle, std::move(callback)});
+    auto [iter, inserted] =
+        exportedFuncs.try_emplace(FuncKey{nameSpace, funcName}, ExportedFuncData{handle, std::move(callback)});
+    if (!inserted) return false;
+    onExported(iter->first, iter->second.callback);
     return true;
 }
 
+int exportFuncs(std::string const& nameSpace, ExportEntry const* entries, size_t count, void* handle) {
+    if (nameSpace.find("::") != std::string::npos) {
+        getLogger().error("Namespace can't includes \"::\"");
+        return 0;
+    }
+    struct Exported {
+        size_t            index;
+        FuncKey const*    key;
+        ExportedFuncData* data;
+    };
+    std::vector<Exported> exported;
+    exported.reserve(count);
+    exportedFuncs.reserve(exportedFuncs.size() + count);
+    size_t nameSpaceHash = hashName(nameSpace);
+    for (size_t i = 0; i < count; ++i) {
+        auto& entry = entries[i];
+        if (!entry.getMakeCallback()) {
+            getLogger().error("Fail to export [{}::{}], callback is missing", nameSpace, entry.getFuncName());
+            continue;
+        }
+        auto [iter, inserted] = exportedFuncs.try_emplace(
+            FuncKey{nameSpace, entry.getFuncName(), combineHash(nameSpaceHash, entry.getHash())},
+            ExportedFuncData{handle, {}}
+        );
+        if (!inserted) {
+            getLogger().warn("Fail to export [{}], it has already been exported", iter->first.key);
+            continue;
+        }
+        iter->second.callback = entry.getMakeCallback()();
+        exported.emplace_back(Exported{i, &iter->first, &iter->second});
+    }
+    // Notify only after the whole table is registered, waiters may call other functions of it
+    size_t removed = removedFuncs;
+    for (auto& [index, key, data] : exported) {
+        if (removed == removedFuncs) {
+            onExported(*key, data->callback);
+            continue;
+        }
+        // A waiter removed functions, the stored nodes may be gone
+        auto iter = exportedFuncs.find(FuncKey{nameSpace, entries[index].getFuncName()});
+        if (iter != exportedFuncs.end()) onExported(iter->first, iter->second.callback);
+    }
+    return static_cast<int>(exported.size());
+}
+
 CallbackFn const& importFunc(std::string const& nameSpace, std::string const& funcName) {
-    auto iter = exportedFuncs.find(nameSpace + "::" + funcName);
+    auto iter = exportedFuncs.find(FuncKey{nameSpace, funcName});
     if (iter == exportedFuncs.end()) return EMPTY_FUNC;
     return iter->second.callback;
 }
 
+std::shared_ptr<ImportBinding> bindFunc(std::string const& nameSpace, std::string const& funcName) {
+    pruneBindings();
+    FuncKey key{nameSpace, funcName};
+    auto&   slot = importBindings[key];
+    if (auto binding = slot.lock()) return binding;
+    auto binding = std::make_shared<ImportBinding>();
+    if (auto iter = exportedFuncs.find(key); iter != exportedFuncs.end()) binding->callback = &iter->second.callback;
+    slot = binding;
+    return binding;
+}
+
+void onFuncExported(
+    std::string const&      nameSpace,
+    std::string const&      funcName,
+    std::function<void()>&& callback,
+    void*                   handle
+) {
+    FuncKey key{nameSpace, funcName};
+    if (exportedFuncs.contains(key)) return callback();
+    exportWaiters[std::move(key)].emplace_back(ExportWaiter{handle, std::move(callback)});
+}
+
+int removeWaiters(void* handle) {
+    int count = 0;
+    for (auto iter = exportWaiters.begin(); iter != exportWaiters.end();) {
+        count += static_cast<int>(std::erase_if(iter->second, [handle](auto& w) { return w.handle == handle; }));
+        if (iter->second.empty()) iter = exportWaiters.erase(iter);
+        else ++iter;
+    }
+    return count;
+}
+
 bool hasFunc(std::string const& nameSpace, std::string const& funcName) {
-    return exportedFuncs.find(nameSpace + "::" + funcName) != exportedFuncs.end();
+    return exportedFuncs.find(FuncKey{nameSpace, funcName}) != exportedFuncs.end();
 }
 
-bool removeFunc(std::string&& key) { return exportedFuncs.erase(key); }
+bool removeFunc(FuncKey&& key) {
+    if (!exportedFuncs.erase(key)) return false;
+    ++removedFuncs;
+    updateBinding(key, nullptr);
+    return true;
+}
 
 bool removeFunc(std::string const& nameSpace, std::string const& funcName) {
-    return removeFunc(nameSpace + "::" + funcName);
+    return removeFunc(FuncKey{nameSpace, funcName});
 }
 
 void _onCallError(std::string const& msg, void* handle) {
@@ -44,8 +174,10 @@ void _onCallError(std::string const& msg, void* handle) {
 int removeNameSpace(std::string const& nameSpace) {
     int count = 0;
     for (auto iter = exportedFuncs.begin(); iter != exportedFuncs.end();) {
-        if (ll::string_utils::splitByPattern(iter->first, "::")[0] == nameSpace) {
+        if (ll::string_utils::splitByPattern(iter->first.key, "::")[0] == nameSpace) {
+            updateBinding(iter->first, nullptr);
             iter = exportedFuncs.erase(iter);
+            ++removedFuncs;
             ++count;
         } else ++iter;
     }
@@ -55,15 +187,65 @@ int removeNameSpace(std::string const& nameSpace) {
 int removeFuncs(std::vector<std::pair<std::string, std::string>>& funcs) {
     int count = 0;
     for (auto& [ns, name] : funcs) {
-        if (removeFunc(ns + "::" + name)) count++;
+        if (removeFunc(FuncKey{ns, name})) count++;
     }
     return count;
 }
 
-void removeAllFunc() { exportedFuncs.clear(); }
+void removeAllFunc() {
+    // Keep the bindings registered, live lazy imports bind again if the function is exported later
+    for (auto& [key, slot] : importBindings) {
+        if (auto binding = slot.lock()) binding->callback = nullptr;
+    }
+    exportWaiters.clear();
+    exportedFuncs.clear();
+    ++removedFuncs;
+}
 
 } // namespace RemoteCall
 
+#ifdef LEGACY_REMOTE_CALL_TEST
+#include <cassert>
+namespace RemoteCall {
+int  TestTableStrSize(std::string arg) { return static_cast<int>(arg.size()); }
+bool TestTableStrEmpty(std::string arg) { return arg.empty(); }
+
+// Runs on enable in debug builds, the logger must be ready for the expected import error
+void testExportTable() {
+    int  waitedBefore = 0;
+    int  waitedAfter  = 0;
+    auto strSize      = importLazyAs<int(std::string)>("TestExportTable", "StrSize");
+    onFuncExported("TestExportTable", "StrSize", [&waitedBefore]() { ++waitedBefore; });
+    assert(waitedBefore == 0);
+
+    static constexpr ExportTable table{
+        "TestExportTable",
+        {exportEntry<&TestTableStrSize>("StrSize"), exportEntry<&TestTableStrEmpty>("StrEmpty")}
+    };
+    assert(exportTable(table) == 2);
+    // Every entry is already exported, all of them are skipped
+    assert(exportTable(table) == 0);
+    assert(waitedBefore == 1);
+    assert(strSize("12345") == 5);
+
+    onFuncExported("TestExportTable", "StrSize", [&waitedAfter]() { ++waitedAfter; });
+    assert(waitedAfter == 1);
+
+    assert(removeFunc("TestExportTable", "StrSize"));
+    assert(!hasFunc("TestExportTable", "StrSize"));
+    // Logs "has not been exported"
+    assert(strSize("12345") == 0);
+    exportAs("TestExportTable", "StrSize", TestTableStrSize);
+    assert(strSize("12345") == 5);
+    assert(waitedBefore == 1 && waitedAfter == 1);
+
+    onFuncExported("TestExportTable", "Pending", []() { assert(false); });
+    assert(removeWaiters() == 1);
+    assert(removeNameSpace("TestExportTable") == 2);
+}
+} // namespace RemoteCall
+#endif // LEGACY_REMOTE_CALL_TEST
+
 static_assert(RemoteCall::is_supported_type_v<void>);
 static_assert(RemoteCall::is_supported_type_v<int>);
 static_assert(RemoteCall::is_supported_type_v<bool>);
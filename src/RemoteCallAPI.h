@@ -29,6 +29,21 @@
 // const strSize = ll.import("TestNameSpace", "strSize");
 // logger.info(`Size of str: ${strSize("12345678")}`);
 //
+// // export many functions at once
+// int  strSize(std::string const& arg) { return arg.size(); }
+// bool strEmpty(std::string const& arg) { return arg.empty(); }
+// static constexpr RemoteCall::ExportTable table{"TestNameSpace", {
+//     RemoteCall::exportEntry<&strSize>("strSize"),
+//     RemoteCall::exportEntry<&strEmpty>("strEmpty"),
+// }};
+// RemoteCall::exportTable(table);
+//
+// // import before the exporter is loaded, bound as soon as it is exported
+// auto lazyStrSize = RemoteCall::importLazyAs<int(std::string const& arg)>("TestNameSpace", "strSize");
+// RemoteCall::onFuncExported("TestNameSpace", "strSize", []() { logger.info("strSize is ready"); });
+// // remove the waiters that never fired before your plugin unloads
+// RemoteCall::removeWaiters();
+//
 /////////////////////////////////////////////////////
 namespace RemoteCall {
 #ifdef TEST_NEW_VALUE_TYPE
@@ -402,12 +417,94 @@ __declspec(dllexport) bool exportFunc(
 );
 __declspec(dllexport) CallbackFn const& importFunc(std::string const& nameSpace, std::string const& funcName);
 
+// FNV-1a, usable at compile time so export entries can carry precomputed hashes
+constexpr size_t hashName(std::string_view str) {
+    unsigned __int64 hash = 14695981039346656037ull;
+    for (char c : str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+}
+
+// Hash of "nameSpace::funcName", the namespace part is hashed once per export table
+constexpr size_t combineHash(size_t nameSpaceHash, size_t funcNameHash) {
+    return nameSpaceHash ^ (funcNameHash + 0x9e3779b97f4a7c15ull + (nameSpaceHash << 6) + (nameSpaceHash >> 2));
+}
+
+constexpr size_t hashKey(std::string_view nameSpace, std::string_view funcName) {
+    return combineHash(hashName(nameSpace), hashName(funcName));
+}
+
+struct ExportEntry {
+    constexpr ExportEntry() = default;
+    constexpr ExportEntry(std::string_view funcName, CallbackFn (*makeCallback)())
+    : funcName(funcName),
+      makeCallback(makeCallback),
+      hash(hashName(funcName)) {}
+
+    constexpr std::string_view getFuncName() const { return funcName; }
+    constexpr auto             getMakeCallback() const { return makeCallback; }
+    constexpr size_t           getHash() const { return hash; }
+
+private:
+    std::string_view funcName{};
+    CallbackFn (*makeCallback)() = nullptr;
+    size_t hash                  = 0;
+};
+
+// Not defined on purpose, calling it while building an ExportTable fails the compilation
+void _duplicateExportName();
+
+template <size_t N>
+struct ExportTable {
+    static_assert(N > 0, "ExportTable can't be empty");
+    std::string_view nameSpace;
+    ExportEntry      entries[N];
+    consteval ExportTable(std::string_view nameSpace, ExportEntry const (&list)[N]) : nameSpace(nameSpace) {
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                if (list[i].getHash() == list[j].getHash() && list[i].getFuncName() == list[j].getFuncName())
+                    _duplicateExportName();
+            }
+            entries[i] = list[i];
+        }
+    }
+};
+
+// Registers all entries in one call, returns the number of functions exported
+// Waiters and lazy imports are notified after the whole table is registered
+__declspec(dllexport) int exportFuncs(
+    std::string const& nameSpace,
+    ExportEntry const* entries,
+    size_t             count,
+    void*              handle = ll::sys_utils::getCurrentModuleHandle()
+);
+
+// Shared by all lazy importers of the same function, updated when it is exported or removed
+struct ImportBinding {
+    CallbackFn const* callback = nullptr;
+};
+
+__declspec(dllexport) std::shared_ptr<ImportBinding>
+bindFunc(std::string const& nameSpace, std::string const& funcName);
+// Calls `callback` once the function is exported, immediately if it already is
+// The callback is owned by `handle`, a plugin must call removeWaiters before it unloads,
+// otherwise a later export runs code of the unloaded plugin
+__declspec(dllexport) void onFuncExported(
+    std::string const&      nameSpace,
+    std::string const&      funcName,
+    std::function<void()>&& callback,
+    void*                   handle = ll::sys_utils::getCurrentModuleHandle()
+);
+// Removes pending onFuncExported callbacks of a plugin, call it before the plugin unloads
+__declspec(dllexport) int removeWaiters(void* handle = ll::sys_utils::getCurrentModuleHandle());
+
 inline ValueType _expandArg(std::vector<ValueType>& args, int& index) { return std::move(args[--index]); }
 
 template <typename RTN, typename... Args>
-inline bool
-_exportAs(std::string const& nameSpace, std::string const& funcName, std::function<RTN(Args...)>&& callback) {
-    CallbackFn cb = [callback = std::move(callback)](std::vector<ValueType> args) -> ValueType {
+inline CallbackFn _wrapCallback(std::function<RTN(Args...)>&& callback) {
+    return [callback = std::move(callback)](std::vector<ValueType> args) -> ValueType {
         if (sizeof...(Args) != args.size()) return std::move(ValueType());
         int index = sizeof...(Args);
         if constexpr (std::is_void_v<RTN>) {
@@ -417,7 +514,27 @@ _exportAs(std::string const& nameSpace, std::string const& funcName, std::functi
             return pack(callback(extract<Args>(_expandArg(args, index))...));
         }
     };
-    return exportFunc(nameSpace, funcName, std::move(cb), ll::sys_utils::getCurrentModuleHandle());
+}
+
+template <typename RTN, typename... Args>
+inline bool
+_exportAs(std::string const& nameSpace, std::string const& funcName, std::function<RTN(Args...)>&& callback) {
+    return exportFunc(nameSpace, funcName, _wrapCallback(std::move(callback)), ll::sys_utils::getCurrentModuleHandle());
+}
+
+template <auto Fn>
+inline CallbackFn _makeCallback() {
+    return _wrapCallback(std::function(Fn));
+}
+
+template <auto Fn>
+constexpr ExportEntry exportEntry(std::string_view funcName) {
+    return ExportEntry{funcName, &_makeCallback<Fn>};
+}
+
+template <size_t N>
+inline int exportTable(ExportTable<N> const& table) {
+    return exportFuncs(std::string(table.nameSpace), table.entries, N, ll::sys_utils::getCurrentModuleHandle());
 }
 
 __declspec(dllexport) bool hasFunc(std::string const& nameSpace, std::string const& funcName);
@@ -441,6 +558,28 @@ inline bool _importAs(std::string const& nameSpace, std::string const& funcName,
     return true;
 }
 
+template <typename RTN, typename... Args>
+inline bool
+_importLazyAs(std::string const& nameSpace, std::string const& funcName, std::function<RTN(Args...)>& func) {
+    func = [nameSpace, funcName, binding = bindFunc(nameSpace, funcName)](Args... args) -> RTN {
+        if (!binding->callback) {
+            _onCallError(fmt::format("Fail to import! Function [{}::{}] has not been exported", nameSpace, funcName));
+            return RTN();
+        }
+        std::vector<ValueType> params = {pack(std::forward<Args>(args))...};
+        ValueType&&            res    = (*binding->callback)(std::move(params));
+        return extract<RTN>(std::move(res));
+    };
+    return true;
+}
+
+template <typename CB, typename Func = std::conditional_t<std::is_function_v<CB>, std::function<CB>, CB>>
+inline Func importLazyAs(std::string const& nameSpace, std::string const& funcName) {
+    Func callback{};
+    _importLazyAs(nameSpace, funcName, callback);
+    return std::move(callback);
+}
+
 template <typename CB, typename Func = std::conditional_t<std::is_function_v<CB>, std::function<CB>, CB>>
 inline Func importAs(std::string const& nameSpace, std::string const& funcName) {
     Func callback{};
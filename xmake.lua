@@ -25,6 +25,9 @@ target("LegacyRemoteCall")
     add_rules("@levibuildscript/modpacker")
     add_cxflags( "/EHa", "/utf-8", "/W4", "/w44265", "/w44289", "/w44296", "/w45263", "/w44738", "/w45204")
     add_defines("NOMINMAX", "UNICODE")
+    if is_mode("debug") then
+        add_defines("LEGACY_REMOTE_CALL_TEST")
+    end
     add_packages("levilamina")
     set_exceptions("none")
     set_kind("shared")